@@ -0,0 +1,171 @@
+#include "csv.h"
+#include "engine.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <mpi.h>
+#include <omp.h>
+
+#define BENCH_REPEAT 3			// Runs of every phase by default, the fastest one is reported.
+#define BENCH_TILE_SIZE 64		// Variables per side of the tiles, as a single process would get.
+#define BENCH_LOWER_BOUND 0.75	// Range of the summary, the default one of -cc.
+#define BENCH_UPPER_BOUND 1.0
+
+static const char* const usage =
+	"usage: corr_bench repeat output_dir file.csv...\n"
+	"Runs the phases of a summary of every file, parse, standardize, correlate, summarize and write, repeat times in\n"
+	"this process with its threads through the engine of the library, and prints the fastest time and the throughput of\n"
+	"each phase as CSV.\n";
+
+typedef enum
+{
+	PHASE_PARSE,
+	PHASE_STANDARDIZE,
+	PHASE_CORRELATE,
+	PHASE_SUMMARIZE,
+	PHASE_WRITE,
+	PHASE_COUNT
+} phase_t;
+
+static const char* const phase_names[PHASE_COUNT] = { "parse", "standardize", "correlate", "summarize", "write" };
+static const char* const phase_units[PHASE_COUNT] = { "bytes", "cells", "pairs", "pairs", "bytes" };
+
+typedef struct
+{
+	double seconds[PHASE_COUNT];	// Fastest time of every phase.
+	double items[PHASE_COUNT];		// Work of every phase, in its unit.
+	int gene_count;					// Observations of the data set.
+	int cancer_count;				// Variables of the data set.
+	int conserved_count;			// Variables the summary kept.
+} bench_result_t;
+
+/**
+ * @brief Runs every phase once over a file and keeps the times that beat the previous runs.
+ * @param input_file Name of the data set.
+ * @param output_file Name of the reduced table.
+ * @param result Times and work of the phases, updated.
+ * @return EXIT_SUCCESS if the file could be read and the output written.
+ * */
+int bench_run(const char* input_file, const char* output_file, bench_result_t* result);
+
+/**
+ * @brief Size of a file.
+ * @param path Name of the file.
+ * @return Its size in bytes, zero if it could not be read.
+ * */
+double file_size(const char* path);
+
+
+int main(int argc, char** argv)
+{
+	if( argc < 4 )
+		return fprintf(stderr, "%s", usage), EXIT_FAILURE;
+
+	int provided = 0;
+	MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+
+	const int repeat = atoi(argv[1]) > 0 ? atoi(argv[1]) : BENCH_REPEAT;
+	int error = EXIT_SUCCESS;
+
+	printf("file,genes,cancers,threads,conserved,phase,seconds,items,unit,items_per_second\n");
+	for(int index = 3; index < argc && !error; ++index)
+	{
+		const char* input_file = argv[index];
+		const char* base_name = strrchr(input_file, '/') ? strrchr(input_file, '/') + 1 : input_file;
+		char* output_file = (char*) malloc( strlen(argv[2]) + strlen(base_name) + 6 );
+		sprintf(output_file, "%s/out_%s", argv[2], base_name);
+
+		bench_result_t result;
+		for(int phase = 0; phase < PHASE_COUNT; ++phase)
+			result.seconds[phase] = -1.0;
+		for(int run = 0; run < repeat && !error; ++run)
+			error = bench_run(input_file, output_file, &result);
+
+		for(int phase = 0; phase < PHASE_COUNT && !error; ++phase)
+		{
+			printf("%s,%d,%d,%d,%d,%s,%.6f,%.0f,%s,%.6g\n", base_name, result.gene_count, result.cancer_count
+				, omp_get_max_threads(), result.conserved_count, phase_names[phase], result.seconds[phase]
+				, result.items[phase], phase_units[phase]
+				, result.seconds[phase] > 0.0 ? result.items[phase] / result.seconds[phase] : 0.0);
+		}
+		fflush(stdout);
+		free(output_file);
+	}
+
+	MPI_Finalize();
+	return error;
+}
+
+int bench_run(const char* input_file, const char* output_file, bench_result_t* result)
+{
+	double times[PHASE_COUNT];
+	csv_t data;
+
+	double start = omp_get_wtime();
+	if( load_file(input_file, &data, false, NULL, NULL) )
+		return EXIT_FAILURE;
+	times[PHASE_PARSE] = omp_get_wtime() - start;
+
+	const int variable_count = data.column_count - 1;
+	const size_t observation_count = data.row_count - 1;
+
+	// The engine of the program on this process alone, keeping every coefficient.
+	engine_t engine;
+	start = omp_get_wtime();
+	engine_open_data(&engine, &data, false, BENCH_TILE_SIZE, 0, MPI_COMM_SELF);
+	times[PHASE_STANDARDIZE] = omp_get_wtime() - start;
+
+	double pair_count = 0.0;
+	for(int index = 0; index < engine.tile_count; ++index)
+		pair_count += engine.tiles[index]->weight;
+
+	// The first query calculates the tiles and summarizes them, the second one only summarizes the kept coefficients.
+	engine_query_t query;
+	memset(&query, 0, sizeof(engine_query_t));
+	query.lower_bound = BENCH_LOWER_BOUND;
+	query.upper_bound = BENCH_UPPER_BOUND;
+	int* correlation_record = (int*) calloc( variable_count + 1, sizeof(int) );
+
+	start = omp_get_wtime();
+	engine_summarize(&engine, &query, correlation_record);
+	const double first_query = omp_get_wtime() - start;
+
+	start = omp_get_wtime();
+	engine_summarize(&engine, &query, correlation_record);
+	times[PHASE_SUMMARIZE] = omp_get_wtime() - start;
+	times[PHASE_CORRELATE] = first_query > times[PHASE_SUMMARIZE] ? first_query - times[PHASE_SUMMARIZE] : 0.0;
+
+	start = omp_get_wtime();
+	int error = engine_write(&engine, correlation_record, output_file);
+	times[PHASE_WRITE] = omp_get_wtime() - start;
+
+	result->gene_count = (int)observation_count;
+	result->cancer_count = variable_count;
+	result->conserved_count = 0;
+	for(int variable = 1; variable <= variable_count; ++variable)
+		result->conserved_count += correlation_record[variable];
+
+	result->items[PHASE_PARSE] = file_size(input_file);
+	result->items[PHASE_STANDARDIZE] = (double)variable_count * observation_count;
+	result->items[PHASE_CORRELATE] = pair_count;
+	result->items[PHASE_SUMMARIZE] = pair_count;
+	result->items[PHASE_WRITE] = file_size(output_file);
+	for(int phase = 0; phase < PHASE_COUNT; ++phase)
+	{
+		if( result->seconds[phase] < 0.0 || times[phase] < result->seconds[phase] )
+			result->seconds[phase] = times[phase];
+	}
+
+	free(correlation_record);
+	engine_close(&engine);
+	return error;
+}
+
+double file_size(const char* path)
+{
+	struct stat status;
+	return stat(path, &status) ? 0.0 : (double)status.st_size;
+}
@@ -0,0 +1,141 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define GENERATE_GROUPS 4		// Groups of correlated cancer types by default.
+#define GENERATE_NOISE 0.5		// Standard deviation of the noise added to the profile of the group by default.
+#define GENERATE_SEED 1			// Seed of the random numbers by default.
+
+static const char* const usage =
+	"usage: corr_generate output.csv genes cancers [groups] [noise] [seed]\n"
+	"Writes a synthetic expression matrix, genes (rows) x cancer types (columns). The cancer types are dealt in turn to\n"
+	"the groups and to one more set of independent ones. The members of a group follow the profile of the group, every\n"
+	"other one reversed, plus noise, so two members correlate about +-1/(1+noise^2) and the independent ones with nobody.\n"
+	"The group of each cancer type is in its name.\n";
+
+typedef struct
+{
+	uint64_t state;			// State of the xorshift64* generator, never zero.
+	double spare;			// Second normal value of the last Box-Muller pair.
+	int has_spare;			// True if spare has not been used yet.
+} random_t;
+
+/**
+ * @brief Uniform random number in (0, 1), from a xorshift64* generator so the files are the same on every platform.
+ * @param random Generator.
+ * @return The number.
+ * */
+double random_uniform(random_t* random);
+
+/**
+ * @brief Standard normal random number, with the Box-Muller transform.
+ * @param random Generator.
+ * @return The number.
+ * */
+double random_normal(random_t* random);
+
+/**
+ * @brief Writes the matrix.
+ * @param path Name of the output file.
+ * @param gene_count Rows of the matrix.
+ * @param cancer_count Columns of the matrix.
+ * @param group_count Groups of correlated cancer types.
+ * @param noise Standard deviation of the noise of every value.
+ * @param seed Seed of the random numbers.
+ * @return EXIT_SUCCESS if the file could be written.
+ * */
+int generate(const char* path, int gene_count, int cancer_count, int group_count, double noise, uint64_t seed);
+
+
+int main(int argc, char** argv)
+{
+	if( argc < 4 || argc > 7 )
+		return fprintf(stderr, "%s", usage), EXIT_FAILURE;
+
+	const int gene_count = atoi(argv[2]);
+	const int cancer_count = atoi(argv[3]);
+	const int group_count = argc > 4 ? atoi(argv[4]) : GENERATE_GROUPS;
+	const double noise = argc > 5 ? atof(argv[5]) : GENERATE_NOISE;
+	const uint64_t seed = argc > 6 ? strtoull(argv[6], NULL, 10) : GENERATE_SEED;
+
+	if( gene_count < 3 || cancer_count < 2 )
+		return fprintf(stderr, "error: at least 3 genes and 2 cancer types are needed\n"), EXIT_FAILURE;
+	if( group_count < 1 )
+		return fprintf(stderr, "error: the number of groups must be positive: %s\n", argv[4]), EXIT_FAILURE;
+	if( noise < 0.0 )
+		return fprintf(stderr, "error: the noise can't be negative: %s\n", argv[5]), EXIT_FAILURE;
+
+	return generate(argv[1], gene_count, cancer_count, group_count, noise, seed);
+}
+
+double random_uniform(random_t* random)
+{
+	random->state ^= random->state >> 12;
+	random->state ^= random->state << 25;
+	random->state ^= random->state >> 27;
+	const uint64_t bits = random->state * 0x2545F4914F6CDD1DULL;
+	return ((bits >> 11) + 0.5) / 9007199254740992.0;
+}
+
+double random_normal(random_t* random)
+{
+	if( random->has_spare )
+	{
+		random->has_spare = 0;
+		return random->spare;
+	}
+
+	const double radius = sqrt( -2.0 * log(random_uniform(random)) );
+	const double angle = 2.0 * M_PI * random_uniform(random);
+	random->spare = radius * sin(angle);
+	random->has_spare = 1;
+	return radius * cos(angle);
+}
+
+int generate(const char* path, int gene_count, int cancer_count, int group_count, double noise, uint64_t seed)
+{
+	FILE* file = fopen(path, "w");
+	if( file == NULL )
+		return fprintf(stderr, "error: could not create file: %s\n", path), EXIT_FAILURE;
+
+	// Splitmix64 step, so close seeds give unrelated streams and zero is allowed.
+	uint64_t state = seed + 0x9E3779B97F4A7C15ULL;
+	state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	state = (state ^ (state >> 27)) * 0x94D049BB133111EBULL;
+	random_t random = { (state ^ (state >> 31)) | 1, 0.0, 0 };
+
+	// Cancer type c goes to set c mod (groups+1), the last set is the independent one.
+	for(int cancer = 0; cancer < cancer_count; ++cancer)
+	{
+		const int group = cancer % (group_count + 1);
+		if( group < group_count )
+			fprintf(file, ",cancer_%d_group_%d", cancer, group);
+		else
+			fprintf(file, ",cancer_%d_independent", cancer);
+	}
+	fputc('\n', file);
+
+	double* profiles = (double*) malloc( (group_count + 1) * sizeof(double) );
+	for(int gene = 0; gene < gene_count; ++gene)
+	{
+		for(int group = 0; group < group_count; ++group)
+			profiles[group] = random_normal(&random);
+		profiles[group_count] = 0.0;
+
+		fprintf(file, "gene_%d", gene);
+		for(int cancer = 0; cancer < cancer_count; ++cancer)
+		{
+			const int group = cancer % (group_count + 1);
+			const double sign = (cancer / (group_count + 1)) % 2 ? -1.0 : 1.0;
+			const double scale = group < group_count ? noise : 1.0;
+			fprintf(file, ",%.6f", sign * profiles[group] + scale * random_normal(&random));
+		}
+		fputc('\n', file);
+	}
+	free(profiles);
+
+	if( fclose(file) )
+		return fprintf(stderr, "error: could not write file: %s\n", path), EXIT_FAILURE;
+	return EXIT_SUCCESS;
+}